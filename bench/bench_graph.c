@@ -0,0 +1,315 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+#ifdef __GLIBC__
+#if __GLIBC_PREREQ(2, 33)
+#include <malloc.h>
+#define BENCH_HAVE_MALLINFO2 1
+#endif
+#endif
+#include "graph.h"
+
+/* ============================================================
+ * Benchmark harness for libgraph
+ *
+ * Times the public API on generated graphs and prints one CSV row
+ * per (shape, nodes, operation):
+ *
+ *   shape,nodes,edges,op,ops,ns_per_op,compares_per_op,result,heap_kb,peak_rss_kb
+ *
+ * result sums what the operation returned: successful inserts,
+ * connects and removes, edge hits, total indegree, neighbors or
+ * payloads returned by the array queries, reachable pairs, whether a
+ * cycle exists. The max_outdegree row reports the largest hub. The
+ * bytes_per_node and bytes_per_edge rows report how much the heap
+ * grew per stored node and per stored edge while building the graph.
+ * They include the unused capacity left by the library's geometric
+ * array growth, so they vary with size and are not a fixed
+ * per-element cost. heap_kb is the malloc heap in use after the
+ * operation (glibc 2.33 or later, -1 elsewhere); peak_rss_kb is the
+ * process high-water mark.
+ *
+ * Usage: bench_graph [max_nodes]
+ *   Sizes run from 1e3 up to max_nodes in steps of 10 (default 1e4).
+ *   Lookups in the library are linear, so sizes past 1e5 take a long
+ *   time. Pass 10000000 to run the full 1e3 to 1e7 range.
+ * ============================================================ */
+
+#define DEFAULT_MAX_NODES 10000
+#define EDGES_PER_NODE    4
+#define MAX_QUERIES       1000
+#define MAX_TRAVERSALS    20
+#define SEED              0x9E3779B97F4A7C15ULL
+
+/* ============================================================
+ * Counting compare callback
+ * ============================================================ */
+
+static unsigned long long compare_calls = 0;
+
+static int compare_ints(const void *a, const void *b) {
+    const int *ia = a;
+    const int *ib = b;
+    ++compare_calls;
+    if (*ia < *ib) return -1;
+    if (*ia > *ib) return 1;
+    return 0;
+}
+
+/* ============================================================
+ * Helpers: timing, memory, random numbers
+ * ============================================================ */
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/* mallinfo2 needs glibc 2.33 or later; older releases report -1 */
+static long long heap_bytes(void) {
+#ifdef BENCH_HAVE_MALLINFO2
+    struct mallinfo2 info = mallinfo2();
+    return (long long)(info.uordblks + info.hblkhd);
+#else
+    return -1;
+#endif
+}
+
+static long heap_kb(void) {
+    long long bytes = heap_bytes();
+    return bytes < 0 ? -1 : (long)(bytes / 1024);
+}
+
+static long peak_rss_kb(void) {
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return -1;
+    return usage.ru_maxrss;
+}
+
+/* xorshift64*, so every run generates the same graphs */
+static unsigned long long rng_state = SEED;
+
+static size_t rng_below(size_t bound) {
+    rng_state ^= rng_state >> 12;
+    rng_state ^= rng_state << 25;
+    rng_state ^= rng_state >> 27;
+    return (size_t)((rng_state * 0x2545F4914F6CDD1DULL) % bound);
+}
+
+/* ============================================================
+ * Graph shapes
+ *
+ * Each generator fills from/to with node indices and returns the
+ * number of edges written. Duplicate edges are possible in random
+ * and power-law graphs; graph_connect rejects them as usual.
+ * ============================================================ */
+
+typedef size_t (*EdgeGenFn)(size_t nodes, size_t *from, size_t *to);
+
+static size_t gen_chain(size_t nodes, size_t *from, size_t *to) {
+    size_t m = 0;
+    for (size_t i = 0; i + 1 < nodes; ++i) {
+        from[m] = i;
+        to[m] = i + 1;
+        ++m;
+    }
+    return m;
+}
+
+static size_t gen_random(size_t nodes, size_t *from, size_t *to) {
+    size_t m = 0;
+    for (size_t i = 0; i < nodes; ++i) {
+        for (int k = 0; k < EDGES_PER_NODE; ++k) {
+            from[m] = i;
+            to[m] = rng_below(nodes);
+            ++m;
+        }
+    }
+    return m;
+}
+
+/* Preferential attachment: each new node is linked from sources drawn
+ * from earlier edges, so popular nodes grow into high-outdegree hubs */
+static size_t gen_power_law(size_t nodes, size_t *from, size_t *to) {
+    size_t m = 0;
+    for (size_t i = 1; i < nodes; ++i) {
+        for (int k = 0; k < EDGES_PER_NODE; ++k) {
+            from[m] = (m == 0 || rng_below(2) == 0) ? rng_below(i) : from[rng_below(m)];
+            to[m] = i;
+            ++m;
+        }
+    }
+    return m;
+}
+
+/* ============================================================
+ * Reporting
+ * ============================================================ */
+
+static void report(const char *shape, size_t nodes, size_t edges, const char *op,
+                   size_t ops, double elapsed_ns, unsigned long long compares,
+                   long long result) {
+    double per = ops ? (double)ops : 1.0;
+    printf("%s,%zu,%zu,%s,%zu,%.1f,%.1f,%lld,%ld,%ld\n",
+           shape, nodes, edges, op, ops,
+           elapsed_ns / per, (double)compares / per,
+           result, heap_kb(), peak_rss_kb());
+    fflush(stdout);
+}
+
+/* Time `expr` over `ops` iterations, summing its value into the
+ * result column, and report it as `op` */
+#define TIME_OP(op, ops, expr)                                           \
+    do {                                                                 \
+        long long result_ = 0;                                           \
+        compare_calls = 0;                                               \
+        double start_ = now_ns();                                        \
+        for (size_t q = 0; q < (ops); ++q) {                             \
+            result_ += (expr);                                           \
+        }                                                                \
+        report(shape, nodes, edges, (op), (ops), now_ns() - start_,      \
+               compare_calls, result_);                                  \
+    } while (0)
+
+/* Array queries report how many entries came back */
+static int neighbor_count(const Graph *g, const void *payload) {
+    const void * const *neighbors = NULL;
+    int count = 0;
+    graph_get_neighbors(g, payload, &neighbors, &count);
+    return count;
+}
+
+static int payload_count(const Graph *g) {
+    const void * const *payloads = NULL;
+    int count = 0;
+    graph_get_all_payloads(g, &payloads, &count);
+    return count;
+}
+
+/* ============================================================
+ * One benchmark run: build, query, tear down
+ * ============================================================ */
+
+static int run_shape(const char *shape, EdgeGenFn gen, size_t nodes) {
+    size_t max_edges = nodes * EDGES_PER_NODE;
+    int *values = malloc(nodes * sizeof(int));
+    size_t *from = malloc(max_edges * sizeof(size_t));
+    size_t *to = malloc(max_edges * sizeof(size_t));
+    size_t *sample = malloc(MAX_QUERIES * 2 * sizeof(size_t));
+    if (!values || !from || !to || !sample) {
+        free(values);
+        free(from);
+        free(to);
+        free(sample);
+        return -1;
+    }
+
+    // The graph borrows payloads from one block, so destroy_fn is NULL
+    for (size_t i = 0; i < nodes; ++i) {
+        values[i] = (int)i;
+    }
+    size_t edges = gen(nodes, from, to);
+    size_t queries = nodes < MAX_QUERIES ? nodes : MAX_QUERIES;
+    size_t traversals = MAX_TRAVERSALS;
+    for (size_t q = 0; q < queries * 2; ++q) {
+        sample[q] = rng_below(nodes);
+    }
+
+    Graph *g = graph_create(compare_ints, NULL);
+    if (!g) {
+        free(values);
+        free(from);
+        free(to);
+        free(sample);
+        return -1;
+    }
+
+    long long heap_empty = heap_bytes();
+    TIME_OP("insert", nodes, graph_insert(g, &values[q]) == GRAPH_STATUS_OK);
+    long long heap_nodes = heap_bytes();
+    TIME_OP("connect", edges,
+            graph_connect(g, &values[from[q]], &values[to[q]]) == GRAPH_STATUS_OK);
+    long long heap_edges = heap_bytes();
+    TIME_OP("has_edge", queries,
+            graph_has_edge(g, &values[sample[2 * q]], &values[sample[2 * q + 1]]));
+    TIME_OP("indegree", queries, graph_indegree(g, &values[sample[q]]));
+    TIME_OP("get_neighbors", queries, neighbor_count(g, &values[sample[q]]));
+    TIME_OP("get_all_payloads", queries, payload_count(g));
+    TIME_OP("reachable", traversals,
+            graph_reachable(g, &values[sample[2 * q]], &values[sample[2 * q + 1]]));
+    TIME_OP("has_cycle", 1, graph_has_cycle(g));
+
+    // Hub size drives adjacency scans in connect and has_edge
+    int max_degree = 0;
+    compare_calls = 0;
+    double scan_start = now_ns();
+    for (size_t i = 0; i < nodes; ++i) {
+        int degree = graph_outdegree(g, &values[i]);
+        if (degree > max_degree) max_degree = degree;
+    }
+    report(shape, nodes, edges, "max_outdegree", nodes, now_ns() - scan_start,
+           compare_calls, max_degree);
+
+    // Storage cost of the layout, measured by heap growth during the build
+    int stored_edges = graph_edge_count(g);
+    if (heap_empty >= 0) {
+        report(shape, nodes, edges, "bytes_per_node", 0, 0.0, 0,
+               (heap_nodes - heap_empty) / (long long)nodes);
+        report(shape, nodes, edges, "bytes_per_edge", 0, 0.0, 0,
+               stored_edges ? (heap_edges - heap_nodes) / stored_edges : 0);
+    }
+
+    // Remove distinct nodes: 7919 is prime and coprime to every
+    // power-of-ten size, so the stride never picks a node twice
+    size_t start = rng_below(nodes);
+    TIME_OP("remove", queries,
+            graph_remove(g, &values[(start + q * 7919) % nodes]) == GRAPH_STATUS_OK);
+
+    graph_destroy(g);
+    free(values);
+    free(from);
+    free(to);
+    free(sample);
+    return 0;
+}
+
+/* ============================================================
+ * Entry point
+ * ============================================================ */
+
+int main(int argc, char **argv) {
+    size_t max_nodes = DEFAULT_MAX_NODES;
+    if (argc > 1) {
+        char *end = NULL;
+        unsigned long long parsed = strtoull(argv[1], &end, 10);
+        if (end == argv[1] || *end != '\0' || parsed < 1000) {
+            fprintf(stderr, "usage: %s [max_nodes >= 1000]\n", argv[0]);
+            return 2;
+        }
+        max_nodes = (size_t)parsed;
+    }
+
+    struct {
+        const char *name;
+        EdgeGenFn gen;
+    } shapes[] = {
+        { "chain", gen_chain },
+        { "random", gen_random },
+        { "power_law", gen_power_law },
+    };
+
+    printf("shape,nodes,edges,op,ops,ns_per_op,compares_per_op,result,heap_kb,peak_rss_kb\n");
+    for (size_t nodes = 1000; nodes <= max_nodes; nodes *= 10) {
+        for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); ++s) {
+            rng_state = SEED;
+            if (run_shape(shapes[s].name, shapes[s].gen, nodes) != 0) {
+                fprintf(stderr, "%s: out of memory at %zu nodes\n", shapes[s].name, nodes);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
@@ -36,6 +36,13 @@ typedef enum GraphStatus {
 
 /* ============================================================
  * Opaque Type
+ *
+ * A Graph does no internal locking. Calls that only read the graph may
+ * run concurrently from several threads. Any call that modifies it needs
+ * exclusive access, and it invalidates arrays that readers borrowed
+ * earlier. Every lookup calls compare_fn, so it must be safe to call from
+ * several threads at once, and a read gives no ordering guarantee
+ * against a concurrent writer.
  * ============================================================ */
 typedef struct Graph Graph;
 
@@ -109,6 +116,11 @@ GraphStatus graph_insert(Graph *g, void *payload);
  *   - Returns `GRAPH_STATUS_NOT_FOUND` if either endpoint is missing.
  *   - Returns `GRAPH_STATUS_DUPLICATE_EDGE` when the directed edge already exists.
  *   - Returns `GRAPH_STATUS_NULL_ARGUMENT` when `g`, `from`, or `to` is NULL.
+ *
+ * Note:
+ *   The edge records the `to` pointer exactly as passed, and that pointer is
+ *   what `graph_get_neighbors` later reports. Pass the payload pointer that
+ *   was inserted, not a temporary with an equal key.
  */
 GraphStatus graph_connect(Graph *g, const void *from, const void *to);
 
@@ -290,6 +302,11 @@ GraphStatus graph_disconnect(Graph *g, const void *from, const void *to);
  *     - `GRAPH_STATUS_OK` when the payload existed and was removed.
  *     - `GRAPH_STATUS_NOT_FOUND` when the payload is missing.
  *     - `GRAPH_STATUS_NULL_ARGUMENT` when `g` or `payload` is NULL.
+ *
+ * Note:
+ *   destroy_fn is called on the `payload` pointer that was passed in, not on
+ *   the stored one. Pass the payload pointer that was inserted, not a
+ *   temporary with an equal key.
  */
 GraphStatus graph_remove(Graph *g, const void *payload);
 
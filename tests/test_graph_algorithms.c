@@ -354,6 +354,473 @@ START_TEST(test_empty_graph_connected)
 }
 END_TEST
 
+/* ============================================================
+ * Test: traversals over a long chain
+ * ============================================================ */
+START_TEST(test_long_chain_traversals)
+{
+    const int NUM_NODES = 2000;
+    int *nodes[NUM_NODES];
+
+    // Create and insert all nodes
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = i;
+        graph_insert(g, nodes[i]);
+    }
+    // Connect nodes in a chain
+    for (int i = 0; i < NUM_NODES - 1; ++i) {
+        graph_connect(g, nodes[i], nodes[i + 1]);
+    }
+
+    // Edges are directed, so only the forward direction is reachable
+    ck_assert(graph_reachable(g, nodes[0], nodes[NUM_NODES - 1]));
+    ck_assert(!graph_reachable(g, nodes[NUM_NODES - 1], nodes[0]));
+    ck_assert(graph_is_connected(g));
+    ck_assert(!graph_has_cycle(g));
+
+    // A single back edge at the far end closes the cycle
+    graph_connect(g, nodes[NUM_NODES - 1], nodes[NUM_NODES / 2]);
+    ck_assert(graph_has_cycle(g));
+    ck_assert(!graph_reachable(g, nodes[NUM_NODES - 1], nodes[0]));
+}
+END_TEST
+
+/* ============================================================
+ * Test: traversals over two disjoint components
+ * ============================================================ */
+START_TEST(test_disjoint_components)
+{
+    const int NUM_NODES = 20;
+    int *nodes[NUM_NODES];
+
+    // Create and insert all nodes
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = i;
+        graph_insert(g, nodes[i]);
+    }
+    // Two chains: 0..9 and 10..19, with no edge between them
+    for (int i = 0; i < NUM_NODES - 1; ++i) {
+        if (i == NUM_NODES / 2 - 1) continue;
+        graph_connect(g, nodes[i], nodes[i + 1]);
+    }
+
+    ck_assert(graph_reachable(g, nodes[0], nodes[NUM_NODES / 2 - 1]));
+    ck_assert(graph_reachable(g, nodes[NUM_NODES / 2], nodes[NUM_NODES - 1]));
+    ck_assert(!graph_reachable(g, nodes[0], nodes[NUM_NODES / 2]));
+    ck_assert(!graph_is_connected(g));
+
+    // Bridging the chains makes every node reachable from the first
+    graph_connect(g, nodes[NUM_NODES / 2 - 1], nodes[NUM_NODES / 2]);
+    ck_assert(graph_reachable(g, nodes[0], nodes[NUM_NODES - 1]));
+    ck_assert(graph_is_connected(g));
+}
+END_TEST
+
+/* ============================================================
+ * Test: repeated reachability queries leave no state behind
+ * ============================================================ */
+START_TEST(test_reachable_repeated_queries)
+{
+    const int NUM_NODES = 40;
+    const int CUT = NUM_NODES / 2;
+    int *nodes[NUM_NODES];
+
+    // Create and insert all nodes
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = i;
+        graph_insert(g, nodes[i]);
+    }
+    // Connect nodes in a chain
+    for (int i = 0; i < NUM_NODES - 1; ++i) {
+        graph_connect(g, nodes[i], nodes[i + 1]);
+    }
+
+    // On a chain, j is reachable from i exactly when i <= j
+    for (int i = 0; i < NUM_NODES; ++i) {
+        for (int j = 0; j < NUM_NODES; ++j) {
+            ck_assert(graph_reachable(g, nodes[i], nodes[j]) == (i <= j));
+        }
+    }
+
+    // Cutting the chain must be visible to the very next query
+    graph_disconnect(g, nodes[CUT - 1], nodes[CUT]);
+    for (int i = 0; i < NUM_NODES; ++i) {
+        for (int j = 0; j < NUM_NODES; ++j) {
+            bool expected = i <= j && !(i < CUT && j >= CUT);
+            ck_assert(graph_reachable(g, nodes[i], nodes[j]) == expected);
+        }
+    }
+}
+END_TEST
+
+/* ============================================================
+ * Test: shared targets or sources do not imply reachability
+ * ============================================================ */
+START_TEST(test_reachable_shared_neighbor)
+{
+    int *a = malloc(sizeof(int));
+    int *b = malloc(sizeof(int));
+    int *c = malloc(sizeof(int));
+    int *d = malloc(sizeof(int));
+    *a = 1;
+    *b = 2;
+    *c = 3;
+    *d = 4;
+
+    graph_insert(g, a);
+    graph_insert(g, b);
+    graph_insert(g, c);
+    graph_insert(g, d);
+
+    // a → c ← b: both reach c, neither reaches the other
+    graph_connect(g, a, c);
+    graph_connect(g, b, c);
+    // d → a, d → b: d reaches both, they do not reach each other
+    graph_connect(g, d, a);
+    graph_connect(g, d, b);
+
+    ck_assert(!graph_reachable(g, a, b));
+    ck_assert(!graph_reachable(g, b, a));
+    ck_assert(!graph_reachable(g, c, a));
+    ck_assert(graph_reachable(g, d, c));
+}
+END_TEST
+
+/* ============================================================
+ * Test: far-apart endpoints in both directions
+ * ============================================================ */
+START_TEST(test_reachable_far_apart)
+{
+    const int NUM_NODES = 1000;
+    int *nodes[NUM_NODES];
+
+    // Create and insert all nodes
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = i;
+        graph_insert(g, nodes[i]);
+    }
+    // Two chains that both end at the last node: evens and odds
+    for (int i = 0; i + 2 < NUM_NODES; ++i) {
+        graph_connect(g, nodes[i], nodes[i + 2]);
+    }
+    graph_connect(g, nodes[NUM_NODES - 2], nodes[NUM_NODES - 1]);
+
+    // Hit: a long path through one chain
+    ck_assert(graph_reachable(g, nodes[0], nodes[NUM_NODES - 2]));
+    ck_assert(graph_reachable(g, nodes[1], nodes[NUM_NODES - 1]));
+    // Miss: the chains only meet at the sink
+    ck_assert(!graph_reachable(g, nodes[0], nodes[NUM_NODES - 3]));
+    ck_assert(!graph_reachable(g, nodes[NUM_NODES - 1], nodes[0]));
+}
+END_TEST
+
+/* ============================================================
+ * Test: reachability follows every kind of mutation
+ * ============================================================ */
+START_TEST(test_reachable_after_mutations)
+{
+    int *a = malloc(sizeof(int));
+    int *b = malloc(sizeof(int));
+    int *c = malloc(sizeof(int));
+    *a = 1;
+    *b = 2;
+    *c = 3;
+
+    graph_insert(g, a);
+    graph_insert(g, b);
+    graph_insert(g, c);
+
+    ck_assert(!graph_reachable(g, a, c));
+
+    // connect: a → b → c
+    graph_connect(g, a, b);
+    graph_connect(g, b, c);
+    ck_assert(graph_reachable(g, a, c));
+
+    // disconnect, then reconnect
+    graph_disconnect(g, b, c);
+    ck_assert(!graph_reachable(g, a, c));
+    graph_connect(g, b, c);
+    ck_assert(graph_reachable(g, a, c));
+
+    // remove the middle node: the path through it is gone
+    ck_assert_int_eq(graph_remove(g, b), GRAPH_STATUS_OK);
+    ck_assert(!graph_reachable(g, a, c));
+
+    // re-inserting an equal payload does not bring its old edges back
+    int *b2 = malloc(sizeof(int));
+    *b2 = 2;
+    graph_insert(g, b2);
+    ck_assert(!graph_reachable(g, a, c));
+    ck_assert(!graph_reachable(g, a, b2));
+}
+END_TEST
+
+/* ============================================================
+ * Test: cycle state after each edge of an out-of-order DAG build
+ * ============================================================ */
+START_TEST(test_has_cycle_incremental_build)
+{
+    const int NUM_NODES = 50;
+    int *nodes[NUM_NODES];
+
+    // Create and insert all nodes
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = i;
+        graph_insert(g, nodes[i]);
+    }
+    // Edges run against insertion order: i → i-1 and i → i-2
+    for (int i = NUM_NODES - 1; i > 0; --i) {
+        graph_connect(g, nodes[i], nodes[i - 1]);
+        ck_assert(!graph_has_cycle(g));
+        if (i > 1) {
+            graph_connect(g, nodes[i], nodes[i - 2]);
+            ck_assert(!graph_has_cycle(g));
+        }
+    }
+
+    // Closing 0 → last creates a cycle through the whole graph
+    graph_connect(g, nodes[0], nodes[NUM_NODES - 1]);
+    ck_assert(graph_has_cycle(g));
+
+    // Disconnecting the closing edge makes the graph acyclic again
+    graph_disconnect(g, nodes[0], nodes[NUM_NODES - 1]);
+    ck_assert(!graph_has_cycle(g));
+}
+END_TEST
+
+/* ============================================================
+ * Test: removing a node on the only cycle clears it
+ * ============================================================ */
+START_TEST(test_has_cycle_after_remove)
+{
+    int *a = malloc(sizeof(int));
+    int *b = malloc(sizeof(int));
+    int *c = malloc(sizeof(int));
+    *a = 1;
+    *b = 2;
+    *c = 3;
+
+    graph_insert(g, a);
+    graph_insert(g, b);
+    graph_insert(g, c);
+
+    // The cycle b → c → b is not reachable from the first payload
+    graph_connect(g, b, c);
+    graph_connect(g, c, b);
+    ck_assert(graph_has_cycle(g));
+
+    ck_assert_int_eq(graph_remove(g, c), GRAPH_STATUS_OK);
+    ck_assert(!graph_has_cycle(g));
+}
+END_TEST
+
+/* ============================================================
+ * Test: reconverging paths in a DAG are not a cycle
+ * ============================================================ */
+START_TEST(test_no_cycle_reconverging_paths)
+{
+    const int NUM_NODES = 302;
+    const int ROOT = NUM_NODES - 1;
+    int *nodes[NUM_NODES];
+
+    // Create and insert all nodes
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = i;
+        graph_insert(g, nodes[i]);
+    }
+    // A ladder of diamonds: 3k → 3k+1, 3k → 3k+2, both → 3k+3
+    for (int i = 0; i + 3 < ROOT; i += 3) {
+        graph_connect(g, nodes[i], nodes[i + 1]);
+        graph_connect(g, nodes[i], nodes[i + 2]);
+        graph_connect(g, nodes[i + 1], nodes[i + 3]);
+        graph_connect(g, nodes[i + 2], nodes[i + 3]);
+    }
+    // A second root outside the ladder points into visited territory
+    graph_connect(g, nodes[ROOT], nodes[ROOT / 2]);
+
+    ck_assert(!graph_has_cycle(g));
+    ck_assert(!graph_is_connected(g));
+
+    // One edge back into the ladder turns it into a real cycle
+    graph_connect(g, nodes[ROOT - 1], nodes[0]);
+    ck_assert(graph_has_cycle(g));
+}
+END_TEST
+
+/* ============================================================
+ * Test: two cycles joined by a one-way bridge
+ * ============================================================ */
+START_TEST(test_components_one_way_bridge)
+{
+    const int NUM_NODES = 10;
+    const int HALF = NUM_NODES / 2;
+    int *nodes[NUM_NODES];
+
+    // Create and insert all nodes
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = i;
+        graph_insert(g, nodes[i]);
+    }
+    // Ring 0..4 and ring 5..9
+    for (int i = 0; i < HALF; ++i) {
+        graph_connect(g, nodes[i], nodes[(i + 1) % HALF]);
+        graph_connect(g, nodes[HALF + i], nodes[HALF + (i + 1) % HALF]);
+    }
+    // Bridge from the first ring into the second
+    graph_connect(g, nodes[2], nodes[HALF + 3]);
+
+    ck_assert(graph_has_cycle(g));
+    ck_assert(graph_is_connected(g));
+
+    // Every node in a ring reaches every other node of the same ring
+    for (int i = 0; i < HALF; ++i) {
+        for (int j = 0; j < HALF; ++j) {
+            ck_assert(graph_reachable(g, nodes[i], nodes[j]));
+            ck_assert(graph_reachable(g, nodes[HALF + i], nodes[HALF + j]));
+        }
+    }
+    // The bridge only goes one way
+    for (int i = 0; i < HALF; ++i) {
+        ck_assert(graph_reachable(g, nodes[i], nodes[NUM_NODES - 1]));
+        ck_assert(!graph_reachable(g, nodes[HALF + i], nodes[0]));
+    }
+}
+END_TEST
+
+/* ============================================================
+ * Test: is_connected searches from the first inserted payload only
+ * ============================================================ */
+START_TEST(test_connected_from_first_inserted)
+{
+    const int NUM_NODES = 10;
+    int *nodes[NUM_NODES];
+
+    // Create and insert all nodes
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = i;
+        graph_insert(g, nodes[i]);
+    }
+    // Every other node points at the first one: it is a sink
+    for (int i = 1; i < NUM_NODES; ++i) {
+        graph_connect(g, nodes[i], nodes[0]);
+    }
+
+    // Edges are directed, so nothing is reachable from the sink
+    ck_assert(!graph_is_connected(g));
+
+    // Node 1 is now first; make it reach everything else
+    ck_assert_int_eq(graph_remove(g, nodes[0]), GRAPH_STATUS_OK);
+    for (int i = 2; i < NUM_NODES; ++i) {
+        graph_connect(g, nodes[i - 1], nodes[i]);
+    }
+    ck_assert(graph_is_connected(g));
+
+    // Breaking the chain next to the root disconnects the rest
+    graph_disconnect(g, nodes[1], nodes[2]);
+    ck_assert(!graph_is_connected(g));
+}
+END_TEST
+
+/* ============================================================
+ * Test: reachability survives losing the shortest route
+ * ============================================================ */
+START_TEST(test_reachable_alternate_routes)
+{
+    const int NUM_NODES = 12;
+    int *nodes[NUM_NODES];
+
+    // Create and insert all nodes
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = i;
+        graph_insert(g, nodes[i]);
+    }
+    // A long route 0 → 1 → ... → 10 → 11
+    for (int i = 0; i < NUM_NODES - 1; ++i) {
+        graph_connect(g, nodes[i], nodes[i + 1]);
+    }
+    // A medium route 0 → 5 and a direct shortcut 0 → 11
+    graph_connect(g, nodes[0], nodes[5]);
+    graph_connect(g, nodes[0], nodes[NUM_NODES - 1]);
+
+    ck_assert(graph_reachable(g, nodes[0], nodes[NUM_NODES - 1]));
+
+    // Drop routes from shortest to longest
+    graph_disconnect(g, nodes[0], nodes[NUM_NODES - 1]);
+    ck_assert(graph_reachable(g, nodes[0], nodes[NUM_NODES - 1]));
+    graph_disconnect(g, nodes[0], nodes[5]);
+    ck_assert(graph_reachable(g, nodes[0], nodes[NUM_NODES - 1]));
+    graph_disconnect(g, nodes[NUM_NODES / 2], nodes[NUM_NODES / 2 + 1]);
+    ck_assert(!graph_reachable(g, nodes[0], nodes[NUM_NODES - 1]));
+}
+END_TEST
+
+/* ============================================================
+ * Test: a walk over get_neighbors agrees with the built-in queries
+ * ============================================================ */
+START_TEST(test_neighbor_walk_matches_reachable)
+{
+    const int NUM_NODES = 40;
+    int *nodes[NUM_NODES];
+
+    // Create and insert all nodes
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = i;
+        graph_insert(g, nodes[i]);
+    }
+    // Two pseudo-random out-edges per node, leaving some nodes unreached
+    for (int i = 0; i < NUM_NODES; ++i) {
+        graph_connect(g, nodes[i], nodes[(i * 3 + 1) % NUM_NODES]);
+        if (i % 4 != 0) {
+            graph_connect(g, nodes[i], nodes[(i * 5 + 2) % NUM_NODES]);
+        }
+    }
+
+    for (int source = 0; source < NUM_NODES; ++source) {
+        // Breadth-first walk; payload values double as indices
+        bool seen[NUM_NODES];
+        int queue[NUM_NODES];
+        int head = 0;
+        int tail = 0;
+        for (int i = 0; i < NUM_NODES; ++i) seen[i] = false;
+        seen[source] = true;
+        queue[tail++] = source;
+
+        while (head < tail) {
+            const void * const *neighbors = NULL;
+            int count = 0;
+            ck_assert_int_eq(graph_get_neighbors(g, nodes[queue[head++]], &neighbors, &count),
+                             GRAPH_STATUS_OK);
+            for (int j = 0; j < count; ++j) {
+                int next = *(const int *)neighbors[j];
+                if (!seen[next]) {
+                    seen[next] = true;
+                    queue[tail++] = next;
+                }
+            }
+        }
+
+        for (int target = 0; target < NUM_NODES; ++target) {
+            ck_assert(graph_reachable(g, nodes[source], nodes[target]) == seen[target]);
+        }
+        // is_connected walks from the first inserted payload
+        if (source == 0) {
+            ck_assert(graph_is_connected(g) == (tail == NUM_NODES));
+        }
+    }
+}
+END_TEST
+
 /* ============================================================
  * Suite Creation Function
  * 
@@ -392,6 +859,19 @@ Suite *algorithms_suite(void)
     tcase_add_test(tc, test_self_loop_cycle);
     tcase_add_test(tc, test_empty_graph_no_cycle);
     tcase_add_test(tc, test_empty_graph_connected);
+    tcase_add_test(tc, test_long_chain_traversals);
+    tcase_add_test(tc, test_disjoint_components);
+    tcase_add_test(tc, test_reachable_repeated_queries);
+    tcase_add_test(tc, test_reachable_shared_neighbor);
+    tcase_add_test(tc, test_reachable_far_apart);
+    tcase_add_test(tc, test_reachable_after_mutations);
+    tcase_add_test(tc, test_has_cycle_incremental_build);
+    tcase_add_test(tc, test_has_cycle_after_remove);
+    tcase_add_test(tc, test_no_cycle_reconverging_paths);
+    tcase_add_test(tc, test_components_one_way_bridge);
+    tcase_add_test(tc, test_connected_from_first_inserted);
+    tcase_add_test(tc, test_reachable_alternate_routes);
+    tcase_add_test(tc, test_neighbor_walk_matches_reachable);
 
     // Add the test case to the suite
     suite_add_tcase(s, tc);
@@ -1,4 +1,6 @@
 #include <check.h>
+#include <pthread.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include "graph.h"
 
@@ -18,6 +20,27 @@ static void destroy_int(void *p) {
     free(p);
 }
 
+/* Insert a value unless an equal payload is already stored.
+ * Returns the pointer the graph holds for that value. */
+static int *insert_if_absent(Graph *graph, int value) {
+    int *val = malloc(sizeof(int));
+    *val = value;
+    if (graph_insert(graph, val) == GRAPH_STATUS_OK) {
+        return val;
+    }
+    free(val);
+
+    const void * const *payloads = NULL;
+    int count = 0;
+    graph_get_all_payloads(graph, &payloads, &count);
+    for (int i = 0; i < count; ++i) {
+        if (compare_ints(payloads[i], &value) == 0) {
+            return (int *)payloads[i];
+        }
+    }
+    return NULL;
+}
+
 /* ============================================================
  * Setup and Teardown fixtures
  * ============================================================ */
@@ -507,6 +530,265 @@ START_TEST(test_remove_cleans_edges)
 }
 END_TEST
 
+/* ============================================================
+ * Test: bulk edges from one source keep order and reject duplicates
+ * ============================================================ */
+START_TEST(test_connect_bulk_from_hub)
+{
+    const int NUM_NODES = 1000;
+    int *nodes[NUM_NODES];
+
+    // Create and insert all nodes
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = i;
+        graph_insert(g, nodes[i]);
+    }
+    // Hub 0 connects to every other node, newest target first
+    for (int i = NUM_NODES - 1; i > 0; --i) {
+        ck_assert_int_eq(graph_connect(g, nodes[0], nodes[i]), GRAPH_STATUS_OK);
+    }
+    // Replay the whole edge list: every edge is now a duplicate
+    for (int i = NUM_NODES - 1; i > 0; --i) {
+        ck_assert_int_eq(graph_connect(g, nodes[0], nodes[i]), GRAPH_STATUS_DUPLICATE_EDGE);
+    }
+
+    ck_assert_int_eq(graph_edge_count(g), NUM_NODES - 1);
+    ck_assert_int_eq(graph_outdegree(g, nodes[0]), NUM_NODES - 1);
+
+    const void * const *neighbors = NULL;
+    int count = 0;
+
+    ck_assert_int_eq(graph_get_neighbors(g, nodes[0], &neighbors, &count), GRAPH_STATUS_OK);
+    ck_assert_int_eq(count, NUM_NODES - 1);
+    for (int i = 0; i < count; ++i) {
+        ck_assert_ptr_eq(neighbors[i], nodes[NUM_NODES - 1 - i]);
+    }
+}
+END_TEST
+
+/* ============================================================
+ * Test: edges from many sources are counted per source
+ * ============================================================ */
+START_TEST(test_connect_bulk_many_sources)
+{
+    const int NUM_NODES = 100;
+    int *nodes[NUM_NODES];
+
+    // Create and insert all nodes
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = i;
+        graph_insert(g, nodes[i]);
+    }
+    // Interleave sources: node i connects to i+1 and i+2 (mod NUM_NODES)
+    for (int step = 1; step <= 2; ++step) {
+        for (int i = 0; i < NUM_NODES; ++i) {
+            ck_assert_int_eq(graph_connect(g, nodes[i], nodes[(i + step) % NUM_NODES]),
+                             GRAPH_STATUS_OK);
+        }
+    }
+
+    ck_assert_int_eq(graph_edge_count(g), 2 * NUM_NODES);
+    for (int i = 0; i < NUM_NODES; ++i) {
+        ck_assert_int_eq(graph_outdegree(g, nodes[i]), 2);
+        ck_assert_int_eq(graph_indegree(g, nodes[i]), 2);
+        ck_assert(graph_has_edge(g, nodes[i], nodes[(i + 1) % NUM_NODES]));
+        ck_assert(graph_has_edge(g, nodes[i], nodes[(i + 2) % NUM_NODES]));
+        ck_assert(!graph_has_edge(g, nodes[i], nodes[(i + 3) % NUM_NODES]));
+    }
+}
+END_TEST
+
+/* ============================================================
+ * Test: disconnect and reconnect on a hub keep insertion order
+ * ============================================================ */
+START_TEST(test_hub_disconnect_keeps_order)
+{
+    const int NUM_NODES = 500;
+    int *nodes[NUM_NODES];
+
+    // Create and insert all nodes
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = i;
+        graph_insert(g, nodes[i]);
+    }
+    // Hub 0 connects to every other node in ascending order
+    for (int i = 1; i < NUM_NODES; ++i) {
+        graph_connect(g, nodes[0], nodes[i]);
+    }
+    // Drop every even target
+    for (int i = 2; i < NUM_NODES; i += 2) {
+        ck_assert_int_eq(graph_disconnect(g, nodes[0], nodes[i]), GRAPH_STATUS_OK);
+    }
+    for (int i = 1; i < NUM_NODES; ++i) {
+        ck_assert(graph_has_edge(g, nodes[0], nodes[i]) == (i % 2 == 1));
+    }
+
+    // A reconnected edge goes to the back, not back into its old slot
+    ck_assert_int_eq(graph_connect(g, nodes[0], nodes[2]), GRAPH_STATUS_OK);
+
+    const void * const *neighbors = NULL;
+    int count = 0;
+
+    ck_assert_int_eq(graph_get_neighbors(g, nodes[0], &neighbors, &count), GRAPH_STATUS_OK);
+    ck_assert_int_eq(count, NUM_NODES / 2 + 1);
+    for (int i = 0; i < count - 1; ++i) {
+        ck_assert_ptr_eq(neighbors[i], nodes[2 * i + 1]);
+    }
+    ck_assert_ptr_eq(neighbors[count - 1], nodes[2]);
+}
+END_TEST
+
+/* ============================================================
+ * Test: load a graph from a text edge list
+ * ============================================================ */
+START_TEST(test_load_edge_list)
+{
+    // One "from to" pair per line, with repeats and a back edge
+    const char *edge_list =
+        "1 2\n"
+        "2 3\n"
+        "1 3\n"
+        "4 1\n"
+        "1 2\n"
+        "3 1\n";
+
+    int lines = 0;
+    int duplicates = 0;
+    int from = 0;
+    int to = 0;
+    int consumed = 0;
+
+    while (sscanf(edge_list, "%d %d\n%n", &from, &to, &consumed) == 2) {
+        edge_list += consumed;
+        ++lines;
+
+        // Endpoints are created on first sight
+        int *a = insert_if_absent(g, from);
+        int *b = insert_if_absent(g, to);
+        ck_assert_ptr_nonnull(a);
+        ck_assert_ptr_nonnull(b);
+
+        GraphStatus status = graph_connect(g, a, b);
+        if (status == GRAPH_STATUS_DUPLICATE_EDGE) {
+            ++duplicates;
+        } else {
+            ck_assert_int_eq(status, GRAPH_STATUS_OK);
+        }
+    }
+
+    ck_assert_int_eq(lines, 6);
+    ck_assert_int_eq(duplicates, 1);
+    ck_assert_int_eq(graph_size(g), 4);
+    ck_assert_int_eq(graph_edge_count(g), lines - duplicates);
+
+    // Nodes appear in order of first mention in the file
+    const void * const *payloads = NULL;
+    int count = 0;
+    ck_assert_int_eq(graph_get_all_payloads(g, &payloads, &count), GRAPH_STATUS_OK);
+    ck_assert_int_eq(count, 4);
+    for (int i = 0; i < count; ++i) {
+        ck_assert_int_eq(*(const int *)payloads[i], i + 1);
+    }
+
+    int one = 1;
+    int three = 3;
+    ck_assert_int_eq(graph_outdegree(g, &one), 2);
+    ck_assert_int_eq(graph_indegree(g, &one), 2);
+    ck_assert(graph_has_edge(g, &three, &one));
+    ck_assert(graph_has_cycle(g));
+}
+END_TEST
+
+/* ============================================================
+ * Test: build shards on separate threads, then merge them
+ * Each thread owns its shard graph; shards overlap by half
+ * ============================================================ */
+
+#define SHARD_COUNT 4
+#define SHARD_NODES 100
+#define SHARD_STEP  (SHARD_NODES / 2)
+
+typedef struct Shard {
+    Graph *graph;
+    int values[SHARD_NODES];
+    int failures;
+} Shard;
+
+static void *build_shard(void *arg)
+{
+    Shard *shard = arg;
+
+    // Payloads live in the shard, so the shard graph only borrows them
+    for (int i = 0; i < SHARD_NODES; ++i) {
+        if (graph_insert(shard->graph, &shard->values[i]) != GRAPH_STATUS_OK) ++shard->failures;
+    }
+    for (int i = 0; i + 1 < SHARD_NODES; ++i) {
+        if (graph_connect(shard->graph, &shard->values[i], &shard->values[i + 1]) != GRAPH_STATUS_OK) {
+            ++shard->failures;
+        }
+    }
+    return NULL;
+}
+
+START_TEST(test_merge_thread_shards)
+{
+    static Shard shards[SHARD_COUNT];
+    pthread_t threads[SHARD_COUNT];
+
+    for (int s = 0; s < SHARD_COUNT; ++s) {
+        shards[s].graph = graph_create(compare_ints, NULL);
+        ck_assert_ptr_nonnull(shards[s].graph);
+        shards[s].failures = 0;
+        for (int i = 0; i < SHARD_NODES; ++i) {
+            shards[s].values[i] = s * SHARD_STEP + i;
+        }
+    }
+    for (int s = 0; s < SHARD_COUNT; ++s) {
+        ck_assert_int_eq(pthread_create(&threads[s], NULL, build_shard, &shards[s]), 0);
+    }
+    for (int s = 0; s < SHARD_COUNT; ++s) {
+        pthread_join(threads[s], NULL);
+        ck_assert_int_eq(shards[s].failures, 0);
+        ck_assert_int_eq(graph_size(shards[s].graph), SHARD_NODES);
+        ck_assert_int_eq(graph_edge_count(shards[s].graph), SHARD_NODES - 1);
+    }
+
+    // Merge: the final graph owns fresh copies of every distinct value
+    int duplicate_edges = 0;
+    for (int s = 0; s < SHARD_COUNT; ++s) {
+        const void * const *payloads = NULL;
+        int count = 0;
+        graph_get_all_payloads(shards[s].graph, &payloads, &count);
+        for (int i = 0; i < count; ++i) {
+            int *from = insert_if_absent(g, *(const int *)payloads[i]);
+
+            const void * const *neighbors = NULL;
+            int degree = 0;
+            graph_get_neighbors(shards[s].graph, payloads[i], &neighbors, &degree);
+            for (int j = 0; j < degree; ++j) {
+                int *to = insert_if_absent(g, *(const int *)neighbors[j]);
+                if (graph_connect(g, from, to) == GRAPH_STATUS_DUPLICATE_EDGE) ++duplicate_edges;
+            }
+        }
+        graph_destroy(shards[s].graph);
+    }
+
+    // Overlapping halves collapse into one chain
+    const int distinct = (SHARD_COUNT - 1) * SHARD_STEP + SHARD_NODES;
+    ck_assert_int_eq(graph_size(g), distinct);
+    ck_assert_int_eq(graph_edge_count(g), distinct - 1);
+    ck_assert_int_eq(duplicate_edges, (SHARD_COUNT - 1) * (SHARD_STEP - 1));
+
+    int first = 0;
+    int last = distinct - 1;
+    ck_assert(graph_reachable(g, &first, &last));
+    ck_assert(!graph_has_cycle(g));
+}
+END_TEST
+
 /* ============================================================
  * Suite Creation Function
  * 
@@ -549,6 +831,11 @@ Suite *edge_suite(void)
     tcase_add_test(tc, test_disconnect_edge_return_ok);
     tcase_add_test(tc, test_remove_with_incoming_edges);
     tcase_add_test(tc, test_remove_cleans_edges);
+    tcase_add_test(tc, test_connect_bulk_from_hub);
+    tcase_add_test(tc, test_connect_bulk_many_sources);
+    tcase_add_test(tc, test_hub_disconnect_keeps_order);
+    tcase_add_test(tc, test_load_edge_list);
+    tcase_add_test(tc, test_merge_thread_shards);
 
     // Add the test case to the suite
     suite_add_tcase(s, tc);
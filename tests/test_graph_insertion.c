@@ -19,6 +19,14 @@ static void destroy_int(void *p) {
     free(p);
 }
 
+/* Counts destroy_fn calls so ownership hand-off can be checked */
+static int destroy_calls = 0;
+
+static void destroy_int_counted(void *p) {
+    ++destroy_calls;
+    free(p);
+}
+
 /* ============================================================
  * Setup and Teardown fixtures
  * ============================================================ */
@@ -243,6 +251,189 @@ START_TEST(test_destroy_null_destroy_fn)
 }
 END_TEST
 
+/* ============================================================
+ * Test 11: Duplicate detection among many payloads
+ * Inserts values in a scrambled order so a duplicate has to be
+ * found by comparison, not by position
+ * ============================================================ */
+START_TEST(test_insert_duplicate_among_many)
+{
+    const int NUM_NODES = 1000;
+    int *nodes[NUM_NODES];
+
+    // 7919 is prime, so i * 7919 % NUM_NODES visits every value once
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = (i * 7919) % NUM_NODES;
+        ck_assert_int_eq(graph_insert(g, nodes[i]), GRAPH_STATUS_OK);
+    }
+
+    // A fresh allocation with a value that is already stored
+    int *dup = malloc(sizeof(int));
+    *dup = 500;
+
+    ck_assert_int_eq(graph_insert(g, dup), GRAPH_STATUS_DUPLICATE_PAYLOAD);
+    free(dup); // rejected payloads stay owned by the caller
+
+    ck_assert_int_eq(graph_size(g), NUM_NODES);
+}
+END_TEST
+
+/* ============================================================
+ * Test 12: Payload lookup goes through compare_fn
+ * A different pointer holding an equal value must find the node
+ * ============================================================ */
+START_TEST(test_lookup_by_equal_payload)
+{
+    int *a = malloc(sizeof(int));
+    int *b = malloc(sizeof(int));
+    *a = 7;
+    *b = 8;
+
+    graph_insert(g, a);
+    graph_insert(g, b);
+
+    // Stack probes that were never inserted
+    int probe_a = 7;
+    int probe_b = 8;
+
+    ck_assert(graph_contains(g, &probe_a));
+    ck_assert(graph_contains(g, &probe_b));
+
+    // The edge stores `to` as passed, so it must be the real payload
+    ck_assert_int_eq(graph_connect(g, &probe_a, b), GRAPH_STATUS_OK);
+    ck_assert(graph_has_edge(g, a, b));
+    ck_assert(graph_has_edge(g, &probe_a, &probe_b));
+
+    const void * const *neighbors = NULL;
+    int count = 0;
+    ck_assert_int_eq(graph_get_neighbors(g, a, &neighbors, &count), GRAPH_STATUS_OK);
+    ck_assert_int_eq(count, 1);
+    ck_assert_ptr_eq(neighbors[0], b);
+}
+END_TEST
+/* ============================================================
+ * Test 13: Bulk insertion with duplicates mixed into the input
+ * Every value appears twice; only the first copy is stored
+ * ============================================================ */
+START_TEST(test_insert_bulk_with_duplicates)
+{
+    const int NUM_NODES = 2000;
+    int *nodes[NUM_NODES];
+    int inserted = 0;
+
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = i / 2;
+
+        GraphStatus status = graph_insert(g, nodes[i]);
+        if (i % 2 == 0) {
+            ck_assert_int_eq(status, GRAPH_STATUS_OK);
+            ++inserted;
+        } else {
+            ck_assert_int_eq(status, GRAPH_STATUS_DUPLICATE_PAYLOAD);
+            free(nodes[i]);
+            nodes[i] = NULL;
+        }
+    }
+
+    ck_assert_int_eq(graph_size(g), inserted);
+
+    const void * const *payloads = NULL;
+    int count = 0;
+
+    // The first copy of each value is the one kept, in input order
+    ck_assert_int_eq(graph_get_all_payloads(g, &payloads, &count), GRAPH_STATUS_OK);
+    ck_assert_int_eq(count, NUM_NODES / 2);
+    for (int i = 0; i < count; ++i) {
+        ck_assert_ptr_eq(payloads[i], nodes[2 * i]);
+    }
+}
+END_TEST
+/* ============================================================
+ * Test 14: destroy_fn runs exactly once per stored payload
+ * Covers payloads freed by graph_remove and by graph_destroy
+ * ============================================================ */
+START_TEST(test_destroy_fn_called_once_per_payload)
+{
+    const int NUM_NODES = 100;
+    int *nodes[NUM_NODES];
+    Graph *graph = graph_create(compare_ints, destroy_int_counted);
+    ck_assert_ptr_nonnull(graph);
+    destroy_calls = 0;
+
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = i;
+        graph_insert(graph, nodes[i]);
+    }
+    // Edges must not cause extra destroy_fn calls
+    for (int i = 0; i < NUM_NODES - 1; ++i) {
+        graph_connect(graph, nodes[i], nodes[i + 1]);
+    }
+
+    // A rejected duplicate stays owned by the caller
+    int *dup = malloc(sizeof(int));
+    *dup = 0;
+    ck_assert_int_eq(graph_insert(graph, dup), GRAPH_STATUS_DUPLICATE_PAYLOAD);
+    free(dup);
+    ck_assert_int_eq(destroy_calls, 0);
+
+    // graph_remove hands each removed payload to destroy_fn right away
+    for (int i = 0; i < NUM_NODES; i += 2) {
+        ck_assert_int_eq(graph_remove(graph, nodes[i]), GRAPH_STATUS_OK);
+    }
+    ck_assert_int_eq(destroy_calls, NUM_NODES / 2);
+
+    // graph_destroy takes care of the rest
+    graph_destroy(graph);
+    ck_assert_int_eq(destroy_calls, NUM_NODES);
+}
+END_TEST
+/* ============================================================
+ * Test 15: A borrowing copy can change without touching the owner
+ * The copy is built with NULL destroy_fn over the owner's payloads
+ * ============================================================ */
+START_TEST(test_borrowing_copy_is_independent)
+{
+    const int NUM_NODES = 20;
+    int *nodes[NUM_NODES];
+    Graph *owner = graph_create(compare_ints, destroy_int_counted);
+    Graph *copy = graph_create(compare_ints, NULL);
+    ck_assert_ptr_nonnull(owner);
+    ck_assert_ptr_nonnull(copy);
+    destroy_calls = 0;
+
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = i;
+        graph_insert(owner, nodes[i]);
+        graph_insert(copy, nodes[i]);
+    }
+    for (int i = 0; i < NUM_NODES - 1; ++i) {
+        graph_connect(owner, nodes[i], nodes[i + 1]);
+        graph_connect(copy, nodes[i], nodes[i + 1]);
+    }
+
+    // Modify only the copy
+    ck_assert_int_eq(graph_remove(copy, nodes[NUM_NODES / 2]), GRAPH_STATUS_OK);
+    ck_assert_int_eq(graph_disconnect(copy, nodes[0], nodes[1]), GRAPH_STATUS_OK);
+    ck_assert_int_eq(destroy_calls, 0);
+
+    // The owner still has every payload and edge
+    ck_assert_int_eq(graph_size(owner), NUM_NODES);
+    ck_assert_int_eq(graph_edge_count(owner), NUM_NODES - 1);
+    ck_assert(graph_has_edge(owner, nodes[0], nodes[1]));
+    ck_assert(graph_reachable(owner, nodes[0], nodes[NUM_NODES - 1]));
+
+    // Dropping the copy frees nothing; dropping the owner frees all
+    graph_destroy(copy);
+    ck_assert_int_eq(destroy_calls, 0);
+    graph_destroy(owner);
+    ck_assert_int_eq(destroy_calls, NUM_NODES);
+}
+END_TEST
+
 
 /* ============================================================
  * Suite Creation Function
@@ -273,6 +464,11 @@ Suite *insertion_suite(void)
     tcase_add_test(tc, test_create_null_destroy_fn);
     tcase_add_test(tc, test_destroy_null_graph);
     tcase_add_test(tc, test_destroy_null_destroy_fn);
+    tcase_add_test(tc, test_insert_duplicate_among_many);
+    tcase_add_test(tc, test_lookup_by_equal_payload);
+    tcase_add_test(tc, test_insert_bulk_with_duplicates);
+    tcase_add_test(tc, test_destroy_fn_called_once_per_payload);
+    tcase_add_test(tc, test_borrowing_copy_is_independent);
     
 
     // Add the test case to the suite
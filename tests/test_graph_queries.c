@@ -1,4 +1,5 @@
 #include <check.h>
+#include <pthread.h>
 #include <stdlib.h>
 #include "graph.h"
 
@@ -512,6 +513,392 @@ START_TEST(test_contains_null_graph)
 
     }
 END_TEST
+/* ============================================================
+ * Test 15: get all payloads keeps insertion order for many nodes
+ * ============================================================ */
+
+START_TEST(test_get_all_payloads_order_many)
+{
+    const int NUM_NODES = 1000;
+    int *nodes[NUM_NODES];
+
+    // Values are scrambled so the order cannot come from sorting
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = (i * 7919) % NUM_NODES;
+        graph_insert(g, nodes[i]);
+    }
+
+    const void * const *payloads = NULL;
+    int count = 0;
+
+    ck_assert_int_eq(graph_get_all_payloads(g, &payloads, &count), GRAPH_STATUS_OK);
+    ck_assert_int_eq(count, NUM_NODES);
+
+    for (int i = 0; i < NUM_NODES; ++i) {
+        ck_assert_ptr_eq(payloads[i], nodes[i]);
+    }
+}
+END_TEST
+/* ============================================================
+ * Test 16: indegree follows connect and disconnect
+ * ============================================================ */
+
+START_TEST(test_indegree_connect_disconnect)
+{
+    int *a = malloc(sizeof(int));
+    int *b = malloc(sizeof(int));
+    int *c = malloc(sizeof(int));
+    *a = 1;
+    *b = 2;
+    *c = 3;
+
+    graph_insert(g, a);
+    graph_insert(g, b);
+    graph_insert(g, c);
+
+    graph_connect(g, a, c);
+    ck_assert_int_eq(graph_indegree(g, c), 1);
+
+    graph_connect(g, b, c);
+    ck_assert_int_eq(graph_indegree(g, c), 2);
+
+    // A rejected duplicate edge must not be counted
+    ck_assert_int_eq(graph_connect(g, b, c), GRAPH_STATUS_DUPLICATE_EDGE);
+    ck_assert_int_eq(graph_indegree(g, c), 2);
+
+    graph_disconnect(g, a, c);
+    ck_assert_int_eq(graph_indegree(g, c), 1);
+
+    // A failed disconnect must not be counted either
+    ck_assert_int_eq(graph_disconnect(g, a, c), GRAPH_STATUS_NOT_FOUND);
+    ck_assert_int_eq(graph_indegree(g, c), 1);
+
+    // Outgoing edges do not contribute to indegree
+    ck_assert_int_eq(graph_indegree(g, a), 0);
+}
+END_TEST
+
+/* ============================================================
+ * Test 17: indegree follows payload removal
+ * ============================================================ */
+
+START_TEST(test_indegree_after_remove)
+{
+    int *a = malloc(sizeof(int));
+    int *b = malloc(sizeof(int));
+    int *c = malloc(sizeof(int));
+    *a = 1;
+    *b = 2;
+    *c = 3;
+
+    graph_insert(g, a);
+    graph_insert(g, b);
+    graph_insert(g, c);
+
+    graph_connect(g, a, c);
+    graph_connect(g, b, c);
+    graph_connect(g, c, b);
+
+    // Removing a source drops its edge into c
+    ck_assert_int_eq(graph_remove(g, a), GRAPH_STATUS_OK);
+    ck_assert_int_eq(graph_indegree(g, c), 1);
+
+    // Removing c drops both its incoming and its outgoing edges
+    ck_assert_int_eq(graph_remove(g, c), GRAPH_STATUS_OK);
+    ck_assert_int_eq(graph_indegree(g, b), 0);
+
+    // A payload re-inserted after removal starts with no edges
+    int *c2 = malloc(sizeof(int));
+    *c2 = 3;
+    ck_assert_int_eq(graph_insert(g, c2), GRAPH_STATUS_OK);
+    ck_assert_int_eq(graph_indegree(g, c2), 0);
+}
+END_TEST
+/* ============================================================
+ * Test 18: queries by an equal key resolve to the stored node
+ * ============================================================ */
+
+START_TEST(test_queries_by_probe_key)
+{
+    int *a = malloc(sizeof(int));
+    int *b = malloc(sizeof(int));
+    int *c = malloc(sizeof(int));
+    *a = 1;
+    *b = 2;
+    *c = 3;
+
+    graph_insert(g, a);
+    graph_insert(g, b);
+    graph_insert(g, c);
+
+    // Edges are created with the stored pointers (see graph_connect)
+    graph_connect(g, a, b);
+    graph_connect(g, a, c);
+
+    // Stack probes that only share the key
+    int probe_a = 1;
+    int probe_b = 2;
+    int probe_c = 3;
+
+    const void * const *neighbors = NULL;
+    int count = 0;
+
+    // Looking up by probe returns the graph's own payload pointers
+    ck_assert_int_eq(graph_get_neighbors(g, &probe_a, &neighbors, &count), GRAPH_STATUS_OK);
+    ck_assert_int_eq(count, 2);
+    ck_assert_ptr_eq(neighbors[0], b);
+    ck_assert_ptr_eq(neighbors[1], c);
+
+    ck_assert(graph_has_edge(g, &probe_a, &probe_b));
+    ck_assert_int_eq(graph_outdegree(g, &probe_a), 2);
+    ck_assert_int_eq(graph_indegree(g, &probe_c), 1);
+    ck_assert(graph_reachable(g, &probe_a, &probe_c));
+}
+END_TEST
+/* ============================================================
+ * Test 19: concurrent read-only queries on one graph
+ * Check assertions are not thread safe, so readers count their
+ * mismatches and the main thread asserts on the totals
+ * ============================================================ */
+
+#define READER_THREADS 4
+#define READER_NODES   200
+#define READER_ROUNDS  20
+
+static int *reader_nodes[READER_NODES];
+
+static void *reader_thread(void *arg)
+{
+    int *mismatches = arg;
+
+    for (int round = 0; round < READER_ROUNDS; ++round) {
+        for (int i = 0; i < READER_NODES; ++i) {
+            int next = (i + 1) % READER_NODES;
+            const void * const *neighbors = NULL;
+            int count = 0;
+
+            if (!graph_contains(g, reader_nodes[i])) ++*mismatches;
+            if (!graph_has_edge(g, reader_nodes[i], reader_nodes[next])) ++*mismatches;
+            if (graph_has_edge(g, reader_nodes[next], reader_nodes[i])) ++*mismatches;
+            if (graph_outdegree(g, reader_nodes[i]) != 1) ++*mismatches;
+            if (graph_get_neighbors(g, reader_nodes[i], &neighbors, &count) != GRAPH_STATUS_OK
+                || count != 1 || neighbors[0] != reader_nodes[next]) {
+                ++*mismatches;
+            }
+        }
+        // The ring makes every node reachable from every other one
+        if (!graph_reachable(g, reader_nodes[0], reader_nodes[READER_NODES - 1])) ++*mismatches;
+    }
+    return NULL;
+}
+
+START_TEST(test_concurrent_readers)
+{
+    // Build a ring 0 → 1 → ... → READER_NODES-1 → 0
+    for (int i = 0; i < READER_NODES; ++i) {
+        reader_nodes[i] = malloc(sizeof(int));
+        *reader_nodes[i] = i;
+        graph_insert(g, reader_nodes[i]);
+    }
+    for (int i = 0; i < READER_NODES; ++i) {
+        graph_connect(g, reader_nodes[i], reader_nodes[(i + 1) % READER_NODES]);
+    }
+
+    pthread_t threads[READER_THREADS];
+    int mismatches[READER_THREADS] = { 0 };
+
+    for (int t = 0; t < READER_THREADS; ++t) {
+        ck_assert_int_eq(pthread_create(&threads[t], NULL, reader_thread, &mismatches[t]), 0);
+    }
+    for (int t = 0; t < READER_THREADS; ++t) {
+        pthread_join(threads[t], NULL);
+        ck_assert_int_eq(mismatches[t], 0);
+    }
+}
+END_TEST
+/* ============================================================
+ * Test 20: payloads and neighbors are enough to rebuild a graph
+ * ============================================================ */
+
+START_TEST(test_rebuild_from_export)
+{
+    const int NUM_NODES = 50;
+    int *nodes[NUM_NODES];
+
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = (i * 37) % NUM_NODES;
+        graph_insert(g, nodes[i]);
+    }
+    for (int i = 0; i < NUM_NODES; ++i) {
+        graph_connect(g, nodes[i], nodes[(i * 7 + 3) % NUM_NODES]);
+        graph_connect(g, nodes[i], nodes[(i * 11 + 5) % NUM_NODES]);
+    }
+
+    // The copy borrows the payloads, so it must not destroy them
+    Graph *copy = graph_create(compare_ints, NULL);
+    ck_assert_ptr_nonnull(copy);
+
+    const void * const *payloads = NULL;
+    int count = 0;
+    ck_assert_int_eq(graph_get_all_payloads(g, &payloads, &count), GRAPH_STATUS_OK);
+    for (int i = 0; i < count; ++i) {
+        ck_assert_int_eq(graph_insert(copy, (void *)payloads[i]), GRAPH_STATUS_OK);
+    }
+    for (int i = 0; i < count; ++i) {
+        const void * const *neighbors = NULL;
+        int degree = 0;
+        ck_assert_int_eq(graph_get_neighbors(g, payloads[i], &neighbors, &degree), GRAPH_STATUS_OK);
+        for (int j = 0; j < degree; ++j) {
+            ck_assert_int_eq(graph_connect(copy, payloads[i], neighbors[j]), GRAPH_STATUS_OK);
+        }
+    }
+
+    // Same nodes in the same order, same edges in the same order
+    const void * const *copy_payloads = NULL;
+    int copy_count = 0;
+    ck_assert_int_eq(graph_get_all_payloads(copy, &copy_payloads, &copy_count), GRAPH_STATUS_OK);
+    ck_assert_int_eq(copy_count, count);
+    ck_assert_int_eq(graph_edge_count(copy), graph_edge_count(g));
+    for (int i = 0; i < count; ++i) {
+        ck_assert_ptr_eq(copy_payloads[i], payloads[i]);
+
+        const void * const *expected = NULL;
+        const void * const *actual = NULL;
+        int expected_degree = 0;
+        int actual_degree = 0;
+        graph_get_neighbors(g, payloads[i], &expected, &expected_degree);
+        graph_get_neighbors(copy, payloads[i], &actual, &actual_degree);
+        ck_assert_int_eq(actual_degree, expected_degree);
+        for (int j = 0; j < expected_degree; ++j) {
+            ck_assert_ptr_eq(actual[j], expected[j]);
+        }
+        ck_assert_int_eq(graph_indegree(copy, payloads[i]), graph_indegree(g, payloads[i]));
+    }
+
+    graph_destroy(copy);
+}
+END_TEST
+/* ============================================================
+ * Test 21: borrowed arrays are refreshed after every modification
+ * ============================================================ */
+
+START_TEST(test_borrowed_arrays_refresh)
+{
+    int *a = malloc(sizeof(int));
+    int *b = malloc(sizeof(int));
+    int *c = malloc(sizeof(int));
+    *a = 1;
+    *b = 2;
+    *c = 3;
+
+    graph_insert(g, a);
+    graph_insert(g, b);
+    graph_connect(g, a, b);
+
+    const void * const *payloads = NULL;
+    const void * const *neighbors = NULL;
+    int count = 0;
+
+    // Repeated queries with no modification in between agree
+    graph_get_neighbors(g, a, &neighbors, &count);
+    ck_assert_int_eq(count, 1);
+    graph_get_neighbors(g, a, &neighbors, &count);
+    ck_assert_int_eq(count, 1);
+    ck_assert_ptr_eq(neighbors[0], b);
+
+    // insert: the payload list grows
+    graph_insert(g, c);
+    graph_get_all_payloads(g, &payloads, &count);
+    ck_assert_int_eq(count, 3);
+    ck_assert_ptr_eq(payloads[2], c);
+
+    // connect: the neighbor list grows
+    graph_connect(g, a, c);
+    graph_get_neighbors(g, a, &neighbors, &count);
+    ck_assert_int_eq(count, 2);
+    ck_assert_ptr_eq(neighbors[1], c);
+
+    // disconnect: the neighbor list shrinks
+    graph_disconnect(g, a, b);
+    graph_get_neighbors(g, a, &neighbors, &count);
+    ck_assert_int_eq(count, 1);
+    ck_assert_ptr_eq(neighbors[0], c);
+
+    // remove: both lists shrink
+    graph_remove(g, c);
+    graph_get_neighbors(g, a, &neighbors, &count);
+    ck_assert_int_eq(count, 0);
+    graph_get_all_payloads(g, &payloads, &count);
+    ck_assert_int_eq(count, 2);
+    ck_assert_ptr_eq(payloads[0], a);
+    ck_assert_ptr_eq(payloads[1], b);
+}
+END_TEST
+/* ============================================================
+ * Test 22: failed mutations leave the graph exactly as it was
+ * ============================================================ */
+
+START_TEST(test_failed_mutations_change_nothing)
+{
+    const int NUM_NODES = 6;
+    int *nodes[NUM_NODES];
+
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = i;
+        graph_insert(g, nodes[i]);
+    }
+    for (int i = 0; i < NUM_NODES - 1; ++i) {
+        graph_connect(g, nodes[i], nodes[i + 1]);
+    }
+    graph_connect(g, nodes[0], nodes[NUM_NODES - 1]);
+
+    const int size_before = graph_size(g);
+    const int edges_before = graph_edge_count(g);
+
+    // Every call below must fail without changing anything
+    int *dup = malloc(sizeof(int));
+    *dup = 3;
+    int missing = 99;
+
+    ck_assert_int_eq(graph_insert(g, dup), GRAPH_STATUS_DUPLICATE_PAYLOAD);
+    free(dup);
+    ck_assert_int_eq(graph_insert(g, NULL), GRAPH_STATUS_NULL_ARGUMENT);
+    ck_assert_int_eq(graph_connect(g, nodes[0], nodes[1]), GRAPH_STATUS_DUPLICATE_EDGE);
+    ck_assert_int_eq(graph_connect(g, nodes[0], &missing), GRAPH_STATUS_NOT_FOUND);
+    ck_assert_int_eq(graph_connect(g, &missing, nodes[0]), GRAPH_STATUS_NOT_FOUND);
+    ck_assert_int_eq(graph_connect(g, nodes[0], NULL), GRAPH_STATUS_NULL_ARGUMENT);
+    ck_assert_int_eq(graph_disconnect(g, nodes[1], nodes[0]), GRAPH_STATUS_NOT_FOUND);
+    ck_assert_int_eq(graph_disconnect(g, &missing, nodes[0]), GRAPH_STATUS_NOT_FOUND);
+    ck_assert_int_eq(graph_remove(g, &missing), GRAPH_STATUS_NOT_FOUND);
+    ck_assert_int_eq(graph_remove(g, NULL), GRAPH_STATUS_NULL_ARGUMENT);
+
+    ck_assert_int_eq(graph_size(g), size_before);
+    ck_assert_int_eq(graph_edge_count(g), edges_before);
+
+    const void * const *payloads = NULL;
+    int count = 0;
+    graph_get_all_payloads(g, &payloads, &count);
+    ck_assert_int_eq(count, NUM_NODES);
+    for (int i = 0; i < NUM_NODES; ++i) {
+        ck_assert_ptr_eq(payloads[i], nodes[i]);
+    }
+
+    // Node 0 still has its two edges, in their original order
+    const void * const *neighbors = NULL;
+    graph_get_neighbors(g, nodes[0], &neighbors, &count);
+    ck_assert_int_eq(count, 2);
+    ck_assert_ptr_eq(neighbors[0], nodes[1]);
+    ck_assert_ptr_eq(neighbors[1], nodes[NUM_NODES - 1]);
+    for (int i = 1; i < NUM_NODES - 1; ++i) {
+        graph_get_neighbors(g, nodes[i], &neighbors, &count);
+        ck_assert_int_eq(count, 1);
+        ck_assert_ptr_eq(neighbors[0], nodes[i + 1]);
+    }
+}
+END_TEST
 
 
 
@@ -557,6 +944,14 @@ Suite *queries_suite(void)
     tcase_add_test(tc, test_size_null_graph);
     tcase_add_test(tc, test_contains_false_graph);
     tcase_add_test(tc, test_contains_null_graph);
+    tcase_add_test(tc, test_get_all_payloads_order_many);
+    tcase_add_test(tc, test_indegree_connect_disconnect);
+    tcase_add_test(tc, test_indegree_after_remove);
+    tcase_add_test(tc, test_queries_by_probe_key);
+    tcase_add_test(tc, test_concurrent_readers);
+    tcase_add_test(tc, test_rebuild_from_export);
+    tcase_add_test(tc, test_borrowed_arrays_refresh);
+    tcase_add_test(tc, test_failed_mutations_change_nothing);
 
     // Add the test case to the suite
     suite_add_tcase(s, tc);
@@ -133,6 +133,211 @@ START_TEST(test_remove_payload_null_graph)
     }
 END_TEST
 
+/* ============================================================
+ * Test 5: graph remove drops the edge from every predecessor
+ * ============================================================ */
+
+START_TEST(test_remove_purges_all_predecessors)
+{
+    const int NUM_NODES = 10;
+    int *nodes[NUM_NODES];
+
+    // Create and insert all nodes
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = i;
+        graph_insert(g, nodes[i]);
+    }
+    // Every other node points at the last node and at its successor
+    for (int i = 0; i < NUM_NODES - 1; ++i) {
+        graph_connect(g, nodes[i], nodes[NUM_NODES - 1]);
+        if (i + 1 < NUM_NODES - 1) {
+            graph_connect(g, nodes[i], nodes[i + 1]);
+        }
+    }
+
+    ck_assert_int_eq(graph_remove(g, nodes[NUM_NODES - 1]), GRAPH_STATUS_OK);
+    ck_assert_int_eq(graph_edge_count(g), NUM_NODES - 2);
+
+    // Each predecessor keeps only its edge to the next node
+    for (int i = 0; i < NUM_NODES - 1; ++i) {
+        const void * const *neighbors = NULL;
+        int count = 0;
+
+        ck_assert_int_eq(graph_get_neighbors(g, nodes[i], &neighbors, &count), GRAPH_STATUS_OK);
+        if (i + 1 < NUM_NODES - 1) {
+            ck_assert_int_eq(count, 1);
+            ck_assert_ptr_eq(neighbors[0], nodes[i + 1]);
+        } else {
+            ck_assert_int_eq(count, 0);
+        }
+    }
+    }
+    END_TEST
+
+/* ============================================================
+ * Test 6: graph remove keeps predecessors' other edges in order
+ * ============================================================ */
+
+START_TEST(test_remove_keeps_predecessor_order)
+{
+    int *a = malloc(sizeof(int));
+    int *b = malloc(sizeof(int));
+    int *c = malloc(sizeof(int));
+    int *d = malloc(sizeof(int));
+    *a = 1;
+    *b = 2;
+    *c = 3;
+    *d = 4;
+
+    graph_insert(g, a);
+    graph_insert(g, b);
+    graph_insert(g, c);
+    graph_insert(g, d);
+
+    // a → b, a → c, a → d; then remove the middle target
+    graph_connect(g, a, b);
+    graph_connect(g, a, c);
+    graph_connect(g, a, d);
+
+    ck_assert_int_eq(graph_remove(g, c), GRAPH_STATUS_OK);
+
+    const void * const *neighbors = NULL;
+    int count = 0;
+
+    ck_assert_int_eq(graph_get_neighbors(g, a, &neighbors, &count), GRAPH_STATUS_OK);
+    ck_assert_int_eq(count, 2);
+    ck_assert_ptr_eq(neighbors[0], b);
+    ck_assert_ptr_eq(neighbors[1], d);
+    ck_assert_int_eq(graph_outdegree(g, a), 2);
+    }
+    END_TEST
+
+/* ============================================================
+ * Test 7: graph remove keeps the remaining payloads in order
+ * ============================================================ */
+
+START_TEST(test_remove_keeps_payload_order)
+{
+    const int NUM_NODES = 100;
+    int *nodes[NUM_NODES];
+
+    // Create and insert all nodes
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = i;
+        graph_insert(g, nodes[i]);
+    }
+    // A ring, so every node has one incoming and one outgoing edge
+    for (int i = 0; i < NUM_NODES; ++i) {
+        graph_connect(g, nodes[i], nodes[(i + 1) % NUM_NODES]);
+    }
+
+    // Remove every tenth node, starting with the first one
+    for (int i = 0; i < NUM_NODES; i += 10) {
+        ck_assert_int_eq(graph_remove(g, nodes[i]), GRAPH_STATUS_OK);
+    }
+
+    // Each removal takes two ring edges with it
+    ck_assert_int_eq(graph_size(g), NUM_NODES - NUM_NODES / 10);
+    ck_assert_int_eq(graph_edge_count(g), NUM_NODES - 2 * (NUM_NODES / 10));
+
+    const void * const *payloads = NULL;
+    int count = 0;
+
+    // Survivors are reported in their original insertion order
+    ck_assert_int_eq(graph_get_all_payloads(g, &payloads, &count), GRAPH_STATUS_OK);
+    ck_assert_int_eq(count, graph_size(g));
+    int k = 0;
+    for (int i = 0; i < NUM_NODES; ++i) {
+        if (i % 10 == 0) continue;
+        ck_assert_ptr_eq(payloads[k], nodes[i]);
+        ++k;
+    }
+    }
+    END_TEST
+
+/* ============================================================
+ * Test 8: graph remove every payload of a dense graph
+ * ============================================================ */
+
+START_TEST(test_remove_all_dense)
+{
+    const int NUM_NODES = 30;
+    int *nodes[NUM_NODES];
+
+    // Create and insert all nodes
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = i;
+        graph_insert(g, nodes[i]);
+    }
+    // Every ordered pair of distinct nodes is an edge
+    for (int i = 0; i < NUM_NODES; ++i) {
+        for (int j = 0; j < NUM_NODES; ++j) {
+            if (i != j) graph_connect(g, nodes[i], nodes[j]);
+        }
+    }
+    ck_assert_int_eq(graph_edge_count(g), NUM_NODES * (NUM_NODES - 1));
+
+    // Remove from the back; remaining nodes stay a complete graph
+    for (int i = NUM_NODES - 1; i >= 0; --i) {
+        ck_assert_int_eq(graph_remove(g, nodes[i]), GRAPH_STATUS_OK);
+        ck_assert_int_eq(graph_edge_count(g), i * (i - 1));
+        if (i > 0) {
+            ck_assert_int_eq(graph_outdegree(g, nodes[0]), i - 1);
+            ck_assert_int_eq(graph_indegree(g, nodes[0]), i - 1);
+        }
+    }
+    ck_assert_int_eq(graph_size(g), 0);
+
+    // The emptied graph is still usable
+    int *again = malloc(sizeof(int));
+    *again = 0;
+    ck_assert_int_eq(graph_insert(g, again), GRAPH_STATUS_OK);
+    ck_assert_int_eq(graph_size(g), 1);
+    }
+    END_TEST
+
+/* ============================================================
+ * Test 9: graph disconnect many edges
+ * ============================================================ */
+
+START_TEST(test_disconnect_many_edges)
+{
+    const int NUM_NODES = 30;
+    int *nodes[NUM_NODES];
+
+    // Create and insert all nodes
+    for (int i = 0; i < NUM_NODES; ++i) {
+        nodes[i] = malloc(sizeof(int));
+        *nodes[i] = i;
+        graph_insert(g, nodes[i]);
+    }
+    for (int i = 0; i < NUM_NODES; ++i) {
+        for (int j = 0; j < NUM_NODES; ++j) {
+            if (i != j) graph_connect(g, nodes[i], nodes[j]);
+        }
+    }
+
+    // Drop every edge that goes "backwards"
+    for (int i = 0; i < NUM_NODES; ++i) {
+        for (int j = 0; j < i; ++j) {
+            ck_assert_int_eq(graph_disconnect(g, nodes[i], nodes[j]), GRAPH_STATUS_OK);
+        }
+    }
+
+    // What is left is a DAG with all payloads still present
+    ck_assert_int_eq(graph_size(g), NUM_NODES);
+    ck_assert_int_eq(graph_edge_count(g), NUM_NODES * (NUM_NODES - 1) / 2);
+    ck_assert(!graph_has_cycle(g));
+    for (int i = 0; i < NUM_NODES; ++i) {
+        ck_assert_int_eq(graph_outdegree(g, nodes[i]), NUM_NODES - 1 - i);
+        ck_assert_int_eq(graph_indegree(g, nodes[i]), i);
+    }
+    }
+    END_TEST
+
 /* ============================================================
  * Suite Creation Function
  * 
@@ -158,6 +363,11 @@ Suite *remove_suite(void)
     tcase_add_test(tc, test_remove_payload_not_found);
     tcase_add_test(tc, test_remove_payload_null_argument);
     tcase_add_test(tc, test_remove_payload_null_graph);
+    tcase_add_test(tc, test_remove_purges_all_predecessors);
+    tcase_add_test(tc, test_remove_keeps_predecessor_order);
+    tcase_add_test(tc, test_remove_keeps_payload_order);
+    tcase_add_test(tc, test_remove_all_dense);
+    tcase_add_test(tc, test_disconnect_many_edges);
 
     // Add the test case to the suite
     suite_add_tcase(s, tc);